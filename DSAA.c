@@ -9,6 +9,13 @@
 #define MAX_ID_LENGTH 10
 #define MAX_DEPARTMENTS 10
 #define MAX_ROOMS 100
+#define MAX_SITES 4
+#define PATIENT_BUCKETS 16
+#define MAX_BATCH_SIZE 100
+
+// Admission result codes stored in AdmissionResult.roomNumber
+#define ROOM_WAITING 0
+#define ROOM_NO_PATIENT -1
 
 // Patient structure
 typedef struct Patient {
@@ -17,6 +24,7 @@ typedef struct Patient {
     int age;
     char gender;
     char diagnosis[MAX_NAME_LENGTH];
+    int roomNumber; // 0 when not admitted
     struct Patient* next;
 } Patient;
 
@@ -35,6 +43,26 @@ typedef struct Room {
     char patientId[MAX_ID_LENGTH];
 } Room;
 
+// Outcome of one appointment drained by processAppointmentBatch()
+typedef struct AdmissionResult {
+    char patientId[MAX_ID_LENGTH];
+    char patientName[MAX_NAME_LENGTH];
+    int department;
+    int priority;
+    int roomNumber; // room assigned, or ROOM_WAITING / ROOM_NO_PATIENT
+} AdmissionResult;
+
+// Hospital site structure (one per hospital in the group)
+// Each site owns its patient registry, appointment queue and rooms.
+// The registry is a chained hash table bucketed by patient-ID hash.
+typedef struct Hospital {
+    char name[MAX_NAME_LENGTH];
+    Patient* patientBuckets[PATIENT_BUCKETS];
+    int patientCount;
+    Appointment* appointmentQueue;
+    Room rooms[MAX_ROOMS];
+} Hospital;
+
 // Graph node for hospital layout (for BFS/DFS)
 typedef struct HospitalNode {
     int id;
@@ -63,9 +91,12 @@ typedef struct Queue {
 } Queue;
 
 // Global variables
-Patient* patientList = NULL;
-Appointment* appointmentQueue = NULL;
-Room rooms[MAX_ROOMS];
+Hospital hospitals[MAX_SITES];
+int numHospitals = 0;
+Hospital* currentHospital = NULL;
+char siteNames[MAX_SITES][MAX_NAME_LENGTH] = {
+    "Central Hospital", "North Campus", "South Campus", "East Clinic"
+};
 char departments[MAX_DEPARTMENTS][MAX_NAME_LENGTH] = {
     "Emergency", "Cardiology", "Radiology", "Pediatrics", 
     "Orthopedics", "Neurology", "Oncology", "General", 
@@ -88,18 +119,33 @@ bool isQueueFull(Queue* queue);
 bool isQueueEmpty(Queue* queue);
 void enqueue(Queue* queue, int item);
 int dequeue(Queue* queue);
-void addPatient();
-void displayPatients();
-Patient* searchPatient(char id[]);
-void deletePatient(char id[]);
-void addAppointment();
-void processAppointments();
-void displayAppointments();
-void initializeRooms();
-void assignRoom(char patientId[]);
-void vacateRoom(int roomNumber);
-void displayRoomStatus();
+void initializeHospitals(int count);
+unsigned hashPatientId(const char id[]);
+void insertPatient(Hospital* hospital, Patient* patient);
+Patient* removePatient(Hospital* hospital, char id[]);
+void insertAppointment(Hospital* hospital, Appointment* appointment);
+Hospital* findPatientSite(char id[]);
+void transferPatient(char id[], int destSite);
+void displayGroupStatistics();
+void addPatient(Hospital* hospital);
+void displayPatients(Hospital* hospital);
+Patient* searchPatient(Hospital* hospital, char id[]);
+void deletePatient(Hospital* hospital, char id[]);
+void addAppointment(Hospital* hospital);
+void processAppointments(Hospital* hospital);
+int processAppointmentBatch(Hospital* hospital, int maxCount, AdmissionResult results[], int* admitted, int* waiting);
+void processAppointmentBatchMenu();
+void displayAppointments(Hospital* hospital);
+void initializeRooms(Hospital* hospital);
+int findFreeRoom(Hospital* hospital);
+void assignRoom(Hospital* hospital, char patientId[]);
+void vacateRoom(Hospital* hospital, int roomNumber);
+void displayRoomStatus(Hospital* hospital);
 void hospitalManagementMenu();
+void appointmentManagementMenu();
+void roomManagementMenu();
+void siteSelectionMenu();
+void groupOperationsMenu();
 void departmentNavigationMenu(HospitalGraph* graph);
 
 int main() {
@@ -119,16 +165,19 @@ int main() {
     addDepartmentEdge(&graph, 7, 9);  // General -> Pharmacy
     addDepartmentEdge(&graph, 8, 9);  // ICU -> Pharmacy
     
-    initializeRooms();
+    initializeHospitals(MAX_SITES);
+    currentHospital = &hospitals[0];
     
     int choice;
     do {
-        printf("\n=== Hospital Management System ===\n");
+        printf("\n=== Hospital Management System [%s] ===\n", currentHospital->name);
         printf("1. Patient Management\n");
         printf("2. Appointment Scheduling\n");
         printf("3. Room Management\n");
         printf("4. Department Navigation\n");
-        printf("5. Exit\n");
+        printf("5. Switch Hospital Site\n");
+        printf("6. Group Operations\n");
+        printf("7. Exit\n");
         printf("Enter your choice: ");
         scanf("%d", &choice);
         
@@ -146,12 +195,18 @@ int main() {
                 departmentNavigationMenu(&graph);
                 break;
             case 5:
+                siteSelectionMenu();
+                break;
+            case 6:
+                groupOperationsMenu();
+                break;
+            case 7:
                 printf("Exiting system...\n");
                 break;
             default:
                 printf("Invalid choice. Please try again.\n");
         }
-    } while(choice != 5);
+    } while(choice != 7);
     
     return 0;
 }
@@ -325,13 +380,201 @@ int dequeue(Queue* queue) {
     return item;
 }
 
+// Hospital site functions
+void initializeHospitals(int count) {
+    numHospitals = count;
+    for (int s = 0; s < numHospitals; s++) {
+        Hospital* hospital = &hospitals[s];
+        strcpy(hospital->name, siteNames[s]);
+        for (int i = 0; i < PATIENT_BUCKETS; i++) {
+            hospital->patientBuckets[i] = NULL;
+        }
+        hospital->patientCount = 0;
+        hospital->appointmentQueue = NULL;
+        initializeRooms(hospital);
+    }
+}
+
+// djb2 hash, used to pick the registry hash bucket for a patient ID
+unsigned hashPatientId(const char id[]) {
+    unsigned hash = 5381;
+    while (*id) {
+        hash = hash * 33 + (unsigned char)*id++;
+    }
+    return hash;
+}
+
+void insertPatient(Hospital* hospital, Patient* patient) {
+    unsigned bucket = hashPatientId(patient->id) % PATIENT_BUCKETS;
+    patient->next = hospital->patientBuckets[bucket];
+    hospital->patientBuckets[bucket] = patient;
+    hospital->patientCount++;
+}
+
+// Unlink a patient from its hash bucket without freeing it
+Patient* removePatient(Hospital* hospital, char id[]) {
+    unsigned bucket = hashPatientId(id) % PATIENT_BUCKETS;
+    Patient *current = hospital->patientBuckets[bucket], *prev = NULL;
+    
+    while (current != NULL && strcmp(current->id, id) != 0) {
+        prev = current;
+        current = current->next;
+    }
+    
+    if (current == NULL) return NULL;
+    
+    if (prev == NULL) {
+        hospital->patientBuckets[bucket] = current->next;
+    } else {
+        prev->next = current->next;
+    }
+    current->next = NULL;
+    hospital->patientCount--;
+    return current;
+}
+
+Patient* searchPatient(Hospital* hospital, char id[]) {
+    Patient* current = hospital->patientBuckets[hashPatientId(id) % PATIENT_BUCKETS];
+    while (current != NULL) {
+        if (strcmp(current->id, id) == 0) {
+            return current;
+        }
+        current = current->next;
+    }
+    return NULL;
+}
+
+// Insert based on priority (priority queue)
+void insertAppointment(Hospital* hospital, Appointment* appointment) {
+    if (hospital->appointmentQueue == NULL || appointment->priority < hospital->appointmentQueue->priority) {
+        appointment->next = hospital->appointmentQueue;
+        hospital->appointmentQueue = appointment;
+    } else {
+        Appointment* current = hospital->appointmentQueue;
+        while (current->next != NULL && current->next->priority <= appointment->priority) {
+            current = current->next;
+        }
+        appointment->next = current->next;
+        current->next = appointment;
+    }
+}
+
+// Routing: locate the site that currently holds a patient by checking each site in turn
+Hospital* findPatientSite(char id[]) {
+    for (int s = 0; s < numHospitals; s++) {
+        if (searchPatient(&hospitals[s], id) != NULL) {
+            return &hospitals[s];
+        }
+    }
+    return NULL;
+}
+
+// Move a patient, their pending appointments and their bed to another site
+void transferPatient(char id[], int destSite) {
+    if (destSite < 0 || destSite >= numHospitals) {
+        printf("Invalid site number.\n");
+        return;
+    }
+    
+    Hospital* source = findPatientSite(id);
+    if (source == NULL) {
+        printf("Patient not found.\n");
+        return;
+    }
+    
+    Hospital* dest = &hospitals[destSite];
+    if (source == dest) {
+        printf("Patient %s is already at %s.\n", id, dest->name);
+        return;
+    }
+    
+    if (searchPatient(dest, id) != NULL) {
+        printf("Patient ID %s is already registered at %s. Transfer cancelled.\n", id, dest->name);
+        return;
+    }
+    
+    // A patient holding a bed needs a free bed at the destination
+    Patient* patient = searchPatient(source, id);
+    int sourceRoom = patient->roomNumber, destRoom = -1;
+    if (sourceRoom != 0) {
+        destRoom = findFreeRoom(dest);
+        if (destRoom == -1) {
+            printf("No rooms available at %s. Transfer cancelled.\n", dest->name);
+            return;
+        }
+    }
+    
+    insertPatient(dest, removePatient(source, id));
+    
+    Appointment *current = source->appointmentQueue, *prev = NULL;
+    while (current != NULL) {
+        Appointment* next = current->next;
+        if (strcmp(current->patientId, id) == 0) {
+            if (prev == NULL) {
+                source->appointmentQueue = next;
+            } else {
+                prev->next = next;
+            }
+            insertAppointment(dest, current);
+        } else {
+            prev = current;
+        }
+        current = next;
+    }
+    
+    printf("Patient %s transferred from %s to %s.\n", id, source->name, dest->name);
+    if (sourceRoom != 0) {
+        source->rooms[sourceRoom-1].occupied = false;
+        strcpy(source->rooms[sourceRoom-1].patientId, "");
+        dest->rooms[destRoom].occupied = true;
+        strcpy(dest->rooms[destRoom].patientId, id);
+        patient->roomNumber = dest->rooms[destRoom].number;
+        printf("Assigned room %d to patient %s\n", patient->roomNumber, id);
+    }
+}
+
+void displayGroupStatistics() {
+    int totalPatients = 0, totalAppointments = 0, totalOccupied = 0;
+    
+    printf("\n=== Group Statistics ===\n");
+    printf("%-20s %-10s %-14s %-10s\n", "Site", "Patients", "Appointments", "Occupied");
+    
+    for (int s = 0; s < numHospitals; s++) {
+        Hospital* hospital = &hospitals[s];
+        int appointments = 0, occupied = 0;
+        
+        for (Appointment* a = hospital->appointmentQueue; a != NULL; a = a->next) {
+            appointments++;
+        }
+        for (int i = 0; i < MAX_ROOMS; i++) {
+            if (hospital->rooms[i].occupied) occupied++;
+        }
+        
+        printf("%-20s %-10d %-14d %d/%d\n", 
+               hospital->name, hospital->patientCount, appointments, occupied, MAX_ROOMS);
+        totalPatients += hospital->patientCount;
+        totalAppointments += appointments;
+        totalOccupied += occupied;
+    }
+    
+    printf("%-20s %-10d %-14d %d/%d\n", 
+           "Total", totalPatients, totalAppointments, totalOccupied, MAX_ROOMS * numHospitals);
+}
+
 // Patient management functions
-void addPatient() {
+void addPatient(Hospital* hospital) {
     Patient* newPatient = (Patient*)malloc(sizeof(Patient));
     
     printf("\nEnter patient ID: ");
     scanf("%s", newPatient->id);
     
+    Hospital* site = findPatientSite(newPatient->id);
+    if (site != NULL) {
+        printf("Patient ID %s is already registered at %s.\n", newPatient->id, site->name);
+        free(newPatient);
+        return;
+    }
+    
     printf("Enter patient name: ");
     scanf(" %[^\n]s", newPatient->name);
     
@@ -344,70 +587,53 @@ void addPatient() {
     printf("Enter diagnosis: ");
     scanf(" %[^\n]s", newPatient->diagnosis);
     
-    newPatient->next = patientList;
-    patientList = newPatient;
+    newPatient->roomNumber = 0;
+    insertPatient(hospital, newPatient);
     
     printf("Patient added successfully!\n");
 }
 
-void displayPatients() {
-    if (patientList == NULL) {
+void displayPatients(Hospital* hospital) {
+    if (hospital->patientCount == 0) {
         printf("\nNo patients in the system.\n");
         return;
     }
     
-    Patient* current = patientList;
     printf("\n=== Patient List ===\n");
     printf("%-10s %-20s %-5s %-5s %-20s\n", "ID", "Name", "Age", "Gender", "Diagnosis");
     
-    while (current != NULL) {
-        printf("%-10s %-20s %-5d %-5c %-20s\n", 
-               current->id, current->name, current->age, current->gender, current->diagnosis);
-        current = current->next;
-    }
-}
-
-Patient* searchPatient(char id[]) {
-    Patient* current = patientList;
-    while (current != NULL) {
-        if (strcmp(current->id, id) == 0) {
-            return current;
+    for (int i = 0; i < PATIENT_BUCKETS; i++) {
+        Patient* current = hospital->patientBuckets[i];
+        while (current != NULL) {
+            printf("%-10s %-20s %-5d %-5c %-20s\n", 
+                   current->id, current->name, current->age, current->gender, current->diagnosis);
+            current = current->next;
         }
-        current = current->next;
     }
-    return NULL;
 }
 
-void deletePatient(char id[]) {
-    Patient *current = patientList, *prev = NULL;
-    
-    while (current != NULL && strcmp(current->id, id) != 0) {
-        prev = current;
-        current = current->next;
-    }
+void deletePatient(Hospital* hospital, char id[]) {
+    Patient* patient = searchPatient(hospital, id);
     
-    if (current == NULL) {
+    if (patient == NULL) {
         printf("Patient not found.\n");
         return;
     }
     
-    if (prev == NULL) {
-        patientList = current->next;
-    } else {
-        prev->next = current->next;
+    if (patient->roomNumber != 0) {
+        vacateRoom(hospital, patient->roomNumber);
     }
-    
-    free(current);
+    free(removePatient(hospital, id));
     printf("Patient deleted successfully.\n");
 }
 
 // Appointment management functions
-void addAppointment() {
+void addAppointment(Hospital* hospital) {
     char patientId[MAX_ID_LENGTH];
     printf("\nEnter patient ID: ");
     scanf("%s", patientId);
     
-    if (searchPatient(patientId) == NULL) {
+    if (searchPatient(hospital, patientId) == NULL) {
         printf("Patient not found. Please add patient first.\n");
         return;
     }
@@ -425,47 +651,138 @@ void addAppointment() {
     printf("Enter priority (1-high to 5-low): ");
     scanf("%d", &newAppointment->priority);
     
-    // Insert based on priority (priority queue)
-    if (appointmentQueue == NULL || newAppointment->priority < appointmentQueue->priority) {
-        newAppointment->next = appointmentQueue;
-        appointmentQueue = newAppointment;
-    } else {
-        Appointment* current = appointmentQueue;
-        while (current->next != NULL && current->next->priority <= newAppointment->priority) {
-            current = current->next;
-        }
-        newAppointment->next = current->next;
-        current->next = newAppointment;
-    }
+    insertAppointment(hospital, newAppointment);
     
     printf("Appointment added successfully!\n");
 }
 
-void processAppointments() {
-    if (appointmentQueue == NULL) {
+void processAppointments(Hospital* hospital) {
+    Appointment* head = hospital->appointmentQueue;
+    if (head == NULL) {
         printf("\nNo appointments to process.\n");
         return;
     }
     
-    printf("\nProcessing appointment for patient ID: %s\n", appointmentQueue->patientId);
-    Patient* patient = searchPatient(appointmentQueue->patientId);
+    printf("\nProcessing appointment for patient ID: %s\n", head->patientId);
+    Patient* patient = searchPatient(hospital, head->patientId);
     if (patient) {
-        printf("Patient: %s, Department: %s\n", patient->name, departments[appointmentQueue->department]);
-        assignRoom(appointmentQueue->patientId);
+        printf("Patient: %s, Department: %s\n", patient->name, departments[head->department]);
+        if (patient->roomNumber == 0 && findFreeRoom(hospital) == -1) {
+            printf("No rooms available! Appointment kept in queue.\n");
+            return;
+        }
+        assignRoom(hospital, head->patientId);
+    }
+    
+    hospital->appointmentQueue = head->next;
+    free(head);
+}
+
+// Drain up to maxCount appointments from the head of the site's queue.
+// Rooms are taken in a single forward sweep of the occupancy array, but each
+// patient is still looked up in its registry hash bucket, so a batch of K costs
+// O(K * N / PATIENT_BUCKETS + MAX_ROOMS) for N patients at the site.
+// Appointments whose patient is gone are dropped (ROOM_NO_PATIENT), and
+// patients already in a bed keep it. Once the beds run out, the remaining
+// appointments that need one stay queued in order and are reported as
+// ROOM_WAITING. Returns the number of entries written to results.
+int processAppointmentBatch(Hospital* hospital, int maxCount, AdmissionResult results[], int* admitted, int* waiting) {
+    Room* rooms = hospital->rooms;
+    Appointment *current = hospital->appointmentQueue, *prev = NULL;
+    int count = 0, nextRoom = 0;
+    
+    *admitted = 0;
+    *waiting = 0;
+    
+    while (current != NULL && count < maxCount) {
+        AdmissionResult* result = &results[count++];
+        strcpy(result->patientId, current->patientId);
+        result->department = current->department;
+        result->priority = current->priority;
+        
+        Patient* patient = searchPatient(hospital, current->patientId);
+        strcpy(result->patientName, patient ? patient->name : "");
+        
+        if (patient == NULL) {
+            result->roomNumber = ROOM_NO_PATIENT;
+        } else if (patient->roomNumber != 0) {
+            result->roomNumber = patient->roomNumber;
+            (*admitted)++;
+        } else {
+            while (nextRoom < MAX_ROOMS && rooms[nextRoom].occupied) {
+                nextRoom++;
+            }
+            if (nextRoom == MAX_ROOMS) {
+                result->roomNumber = ROOM_WAITING;
+                (*waiting)++;
+                prev = current;
+                current = current->next;
+                continue;
+            }
+            rooms[nextRoom].occupied = true;
+            strcpy(rooms[nextRoom].patientId, current->patientId);
+            patient->roomNumber = rooms[nextRoom].number;
+            result->roomNumber = patient->roomNumber;
+            (*admitted)++;
+        }
+        
+        Appointment* temp = current;
+        current = current->next;
+        if (prev == NULL) {
+            hospital->appointmentQueue = current;
+        } else {
+            prev->next = current;
+        }
+        free(temp);
     }
     
-    Appointment* temp = appointmentQueue;
-    appointmentQueue = appointmentQueue->next;
-    free(temp);
+    return count;
 }
 
-void displayAppointments() {
-    if (appointmentQueue == NULL) {
+void processAppointmentBatchMenu() {
+    int batchSize, admitted, waiting;
+    
+    printf("Enter number of appointments to process (1-%d): ", MAX_BATCH_SIZE);
+    scanf("%d", &batchSize);
+    if (batchSize < 1 || batchSize > MAX_BATCH_SIZE) {
+        printf("Invalid batch size.\n");
+        return;
+    }
+    
+    if (currentHospital->appointmentQueue == NULL) {
+        printf("\nNo appointments to process.\n");
+        return;
+    }
+    
+    AdmissionResult* results = (AdmissionResult*)malloc(batchSize * sizeof(AdmissionResult));
+    int count = processAppointmentBatch(currentHospital, batchSize, results, &admitted, &waiting);
+    
+    printf("\n=== Batch Admission ===\n");
+    printf("%-10s %-20s %-20s %-10s\n", "Patient ID", "Name", "Department", "Room");
+    for (int i = 0; i < count; i++) {
+        if (results[i].roomNumber == ROOM_NO_PATIENT) {
+            printf("%-10s %-20s %-20s %-10s\n", results[i].patientId, "N/A", 
+                   departments[results[i].department], "Not found");
+        } else if (results[i].roomNumber == ROOM_WAITING) {
+            printf("%-10s %-20s %-20s %-10s\n", results[i].patientId, results[i].patientName, 
+                   departments[results[i].department], "Waiting");
+        } else {
+            printf("%-10s %-20s %-20s %-10d\n", results[i].patientId, results[i].patientName, 
+                   departments[results[i].department], results[i].roomNumber);
+        }
+    }
+    printf("Admitted: %d, Waiting for beds: %d\n", admitted, waiting);
+    
+    free(results);
+}
+
+void displayAppointments(Hospital* hospital) {
+    if (hospital->appointmentQueue == NULL) {
         printf("\nNo appointments scheduled.\n");
         return;
     }
     
-    Appointment* current = appointmentQueue;
+    Appointment* current = hospital->appointmentQueue;
     printf("\n=== Appointment Queue ===\n");
     printf("%-10s %-20s %-10s\n", "Patient ID", "Department", "Priority");
     
@@ -477,27 +794,51 @@ void displayAppointments() {
 }
 
 // Room management functions
-void initializeRooms() {
+void initializeRooms(Hospital* hospital) {
     for (int i = 0; i < MAX_ROOMS; i++) {
-        rooms[i].number = i + 1;
-        rooms[i].occupied = false;
-        strcpy(rooms[i].patientId, "");
+        hospital->rooms[i].number = i + 1;
+        hospital->rooms[i].occupied = false;
+        strcpy(hospital->rooms[i].patientId, "");
     }
 }
 
-void assignRoom(char patientId[]) {
+// Index of the first vacant room, or -1 when the site is full
+int findFreeRoom(Hospital* hospital) {
     for (int i = 0; i < MAX_ROOMS; i++) {
-        if (!rooms[i].occupied) {
-            rooms[i].occupied = true;
-            strcpy(rooms[i].patientId, patientId);
-            printf("Assigned room %d to patient %s\n", rooms[i].number, patientId);
-            return;
+        if (!hospital->rooms[i].occupied) {
+            return i;
         }
     }
-    printf("No rooms available!\n");
+    return -1;
+}
+
+void assignRoom(Hospital* hospital, char patientId[]) {
+    Patient* patient = searchPatient(hospital, patientId);
+    if (patient == NULL) {
+        printf("Patient not found.\n");
+        return;
+    }
+    
+    if (patient->roomNumber != 0) {
+        printf("Patient %s already occupies room %d\n", patientId, patient->roomNumber);
+        return;
+    }
+    
+    int i = findFreeRoom(hospital);
+    if (i == -1) {
+        printf("No rooms available!\n");
+        return;
+    }
+    
+    Room* room = &hospital->rooms[i];
+    room->occupied = true;
+    strcpy(room->patientId, patientId);
+    patient->roomNumber = room->number;
+    printf("Assigned room %d to patient %s\n", room->number, patientId);
 }
 
-void vacateRoom(int roomNumber) {
+void vacateRoom(Hospital* hospital, int roomNumber) {
+    Room* rooms = hospital->rooms;
     if (roomNumber < 1 || roomNumber > MAX_ROOMS) {
         printf("Invalid room number.\n");
         return;
@@ -509,12 +850,17 @@ void vacateRoom(int roomNumber) {
     }
     
     printf("Room %d vacated by patient %s\n", roomNumber, rooms[roomNumber-1].patientId);
+    Patient* patient = searchPatient(hospital, rooms[roomNumber-1].patientId);
+    if (patient != NULL) {
+        patient->roomNumber = 0;
+    }
     rooms[roomNumber-1].occupied = false;
     strcpy(rooms[roomNumber-1].patientId, "");
 }
 
-void displayRoomStatus() {
-    printf("\n=== Room Status ===\n");
+void displayRoomStatus(Hospital* hospital) {
+    Room* rooms = hospital->rooms;
+    printf("\n=== Room Status: %s ===\n", hospital->name);
     printf("%-10s %-15s %-10s\n", "Room No.", "Occupied", "Patient ID");
     
     for (int i = 0; i < MAX_ROOMS; i++) {
@@ -542,15 +888,15 @@ void hospitalManagementMenu() {
         
         switch(choice) {
             case 1:
-                addPatient();
+                addPatient(currentHospital);
                 break;
             case 2:
-                displayPatients();
+                displayPatients(currentHospital);
                 break;
             case 3:
                 printf("Enter patient ID to search: ");
                 scanf("%s", id);
-                Patient* patient = searchPatient(id);
+                Patient* patient = searchPatient(currentHospital, id);
                 if (patient) {
                     printf("\nPatient Found:\n");
                     printf("ID: %s\nName: %s\nAge: %d\nGender: %c\nDiagnosis: %s\n",
@@ -563,7 +909,7 @@ void hospitalManagementMenu() {
             case 4:
                 printf("Enter patient ID to delete: ");
                 scanf("%s", id);
-                deletePatient(id);
+                deletePatient(currentHospital, id);
                 break;
             case 5:
                 break;
@@ -580,27 +926,31 @@ void appointmentManagementMenu() {
         printf("\n=== Appointment Management ===\n");
         printf("1. Add Appointment\n");
         printf("2. Process Next Appointment\n");
-        printf("3. Display Appointment Queue\n");
-        printf("4. Back to Main Menu\n");
+        printf("3. Process Appointment Batch\n");
+        printf("4. Display Appointment Queue\n");
+        printf("5. Back to Main Menu\n");
         printf("Enter your choice: ");
         scanf("%d", &choice);
         
         switch(choice) {
             case 1:
-                addAppointment();
+                addAppointment(currentHospital);
                 break;
             case 2:
-                processAppointments();
+                processAppointments(currentHospital);
                 break;
             case 3:
-                displayAppointments();
+                processAppointmentBatchMenu();
                 break;
             case 4:
+                displayAppointments(currentHospital);
+                break;
+            case 5:
                 break;
             default:
                 printf("Invalid choice. Please try again.\n");
         }
-    } while(choice != 4);
+    } while(choice != 5);
 }
 
 void roomManagementMenu() {
@@ -620,15 +970,15 @@ void roomManagementMenu() {
             case 1:
                 printf("Enter patient ID to assign room: ");
                 scanf("%s", patientId);
-                assignRoom(patientId);
+                assignRoom(currentHospital, patientId);
                 break;
             case 2:
                 printf("Enter room number to vacate: ");
                 scanf("%d", &roomNumber);
-                vacateRoom(roomNumber);
+                vacateRoom(currentHospital, roomNumber);
                 break;
             case 3:
-                displayRoomStatus();
+                displayRoomStatus(currentHospital);
                 break;
             case 4:
                 break;
@@ -687,3 +1037,68 @@ void departmentNavigationMenu(HospitalGraph* graph) {
         }
     } while(choice != 4);
 }
+
+void siteSelectionMenu() {
+    int site;
+    
+    printf("\n=== Hospital Sites ===\n");
+    for (int s = 0; s < numHospitals; s++) {
+        printf("%d. %s%s\n", s + 1, hospitals[s].name, 
+               &hospitals[s] == currentHospital ? " (current)" : "");
+    }
+    printf("Select site: ");
+    scanf("%d", &site);
+    
+    if (site >= 1 && site <= numHospitals) {
+        currentHospital = &hospitals[site - 1];
+        printf("Now managing %s.\n", currentHospital->name);
+    } else {
+        printf("Invalid site number.\n");
+    }
+}
+
+void groupOperationsMenu() {
+    int choice, destSite;
+    char patientId[MAX_ID_LENGTH];
+    Hospital* site;
+    
+    do {
+        printf("\n=== Group Operations ===\n");
+        printf("1. Transfer Patient to Another Site\n");
+        printf("2. Locate Patient Across Sites\n");
+        printf("3. Display Group Statistics\n");
+        printf("4. Back to Main Menu\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+        
+        switch(choice) {
+            case 1:
+                printf("Enter patient ID to transfer: ");
+                scanf("%s", patientId);
+                for (int s = 0; s < numHospitals; s++) {
+                    printf("%d. %s\n", s + 1, hospitals[s].name);
+                }
+                printf("Enter destination site number: ");
+                scanf("%d", &destSite);
+                transferPatient(patientId, destSite - 1);
+                break;
+            case 2:
+                printf("Enter patient ID to locate: ");
+                scanf("%s", patientId);
+                site = findPatientSite(patientId);
+                if (site) {
+                    printf("Patient %s is registered at %s.\n", patientId, site->name);
+                } else {
+                    printf("Patient not found.\n");
+                }
+                break;
+            case 3:
+                displayGroupStatistics();
+                break;
+            case 4:
+                break;
+            default:
+                printf("Invalid choice. Please try again.\n");
+        }
+    } while(choice != 4);
+}